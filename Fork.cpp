@@ -0,0 +1,19 @@
+#include "Fork.hpp"
+
+int Fork::id = 0;
+
+auto Fork::try_take() const -> Fork::lock_opt {
+    if (lock_type mt_lock{mt, std::defer_lock}; mt_lock.try_lock()) {
+        return mt_lock;
+    }
+    return {};
+}
+
+int Fork::get_id() const {
+    return fork_id;
+}
+
+std::ostream& operator<<(std::ostream& out, const Fork& fork) {
+    out << "fork<" << fork.get_id() << "> ";
+    return out;
+}
@@ -1,5 +1,5 @@
 #pragma once
-#include <iostream>
+#include <ostream>
 #include <mutex>
 #include <optional>
 
@@ -16,20 +16,4 @@ private:
     mutable std::mutex mt;
 };
 
-int Fork::id = 0;
-
-auto Fork::try_take() const -> Fork::lock_opt {
-    if (lock_type mt_lock{mt, std::defer_lock}; mt_lock.try_lock()) {
-        return mt_lock;
-    }
-    return {};
-}
-
-int Fork::get_id() const {
-    return fork_id;
-}
-
-std::ostream& operator<<(std::ostream& out, const Fork& fork) {
-    out << "fork<" << fork.get_id() << "> ";
-    return out;
-}
+std::ostream& operator<<(std::ostream& out, const Fork& fork);
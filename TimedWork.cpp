@@ -0,0 +1,71 @@
+#include "TimedWork.hpp"
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace {
+std::mutex time_mt;
+
+std::random_device r;
+std::default_random_engine e1(r());
+}
+
+WorkStrategy TimedWork::strategy = WorkStrategy::BusySleep;
+
+auto get_pased_duration() -> std::chrono::nanoseconds {
+    std::lock_guard lock{time_mt};
+    static auto start_time = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+}
+
+auto get_time() -> std::chrono::steady_clock::time_point {
+    std::lock_guard lock{time_mt};
+    return std::chrono::steady_clock::now();
+}
+
+auto random(int minimum, int maximum) -> int {
+    std::uniform_int_distribution<int> uniform_dist(minimum, maximum);
+    return uniform_dist(e1);
+}
+
+TimedWork::time_tuple TimedWork::work() const {
+    if (strategy == WorkStrategy::Sleep) {
+        return sleep();
+    }
+    return busy_sleep();
+}
+
+TimedWork::time_tuple TimedWork::busy_sleep() const {
+    const auto start = get_time();
+    const auto end = start + duration;
+
+    while (get_time() < end) {
+        std::this_thread::yield();
+    };
+    
+    return std::make_tuple(start, end, get_time());
+}
+
+TimedWork::time_tuple TimedWork::sleep() const {
+    const auto start = get_time();
+    const auto end = start + duration;
+
+    std::this_thread::sleep_until(end);
+
+    return std::make_tuple(start, end, get_time());
+}
+
+std::ostream& operator<<(std::ostream& out, const TimedWork& work) {
+    out << "for duration: " << work.duration.count() << " us ";
+    return out;
+}
+
+std::ostream& operator<<(std::ostream& out, const TimedWork::time_tuple& times) {
+    const auto start_time = std::get<0>(times);
+    const auto end_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::get<1>(times) - start_time).count();
+    const auto real_end_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::get<2>(times) - start_time).count();
+    
+    out << "time: " << static_cast<double>(end_time) / 1000.0 << " us - ";
+    out << static_cast<double>(real_end_time) / 1000.0 << " us";
+    return out;
+}
@@ -0,0 +1,247 @@
+#include "Philosopher.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+constexpr auto warmup_times = 1; // runs before measuring, not reported
+constexpr auto table_sizes = std::array<size_t, 3>{2, 5, 16};
+constexpr auto acquire_policies = std::array{AcquirePolicy::LastRightHanded, AcquirePolicy::Alternating, AcquirePolicy::AllLeftHanded};
+constexpr auto work_strategies = std::array{WorkStrategy::BusySleep, WorkStrategy::Sleep};
+constexpr auto event_recordings = std::array{EventRecording::Full, EventRecording::ActionsOnly, EventRecording::None};
+
+const Philosopher::Settings bench_settings{
+    .eating_times_count = 300,
+    .eating_time_minimum = 5,
+    .eating_time_maximum = 20,
+    .thinking_time_minimum = 5,
+    .thinking_time_maximum = 20,
+    .recording = EventRecording::Full
+};
+
+struct BenchOptions {
+    std::string output_path{}; // empty or "-" writes to stdout
+    size_t eating_times_count = bench_settings.eating_times_count;
+    int run_times = 10;
+};
+
+struct BenchCase {
+    size_t philosophers_num;
+    AcquirePolicy policy;
+    WorkStrategy strategy;
+    EventRecording recording;
+};
+
+struct BenchResult {
+    BenchCase bench_case;
+    std::vector<std::chrono::nanoseconds> run_durations;
+    size_t events_count;                    // summed over all runs
+    std::optional<size_t> starvation_count; // summed over all runs, unknown when events are not recorded
+};
+
+constexpr auto name_of(AcquirePolicy policy) -> std::string_view {
+    switch (policy) {
+    case AcquirePolicy::LastRightHanded: return "last_right_handed";
+    case AcquirePolicy::Alternating:     return "alternating";
+    case AcquirePolicy::AllLeftHanded:   return "all_left_handed";
+    }
+    return "unknown";
+}
+
+constexpr auto name_of(WorkStrategy strategy) -> std::string_view {
+    switch (strategy) {
+    case WorkStrategy::BusySleep: return "busy_sleep";
+    case WorkStrategy::Sleep:     return "sleep";
+    }
+    return "unknown";
+}
+
+constexpr auto name_of(EventRecording recording) -> std::string_view {
+    switch (recording) {
+    case EventRecording::Full:        return "full";
+    case EventRecording::ActionsOnly: return "actions_only";
+    case EventRecording::None:        return "none";
+    }
+    return "unknown";
+}
+
+BenchResult run_case(const BenchCase& bench_case, const BenchOptions& options) {
+    auto settings = bench_settings;
+    settings.eating_times_count = options.eating_times_count;
+    settings.recording = bench_case.recording;
+    Philosopher::setSettings(settings);
+    TimedWork::setStrategy(bench_case.strategy);
+
+    const auto philosophers_num = bench_case.philosophers_num;
+    std::vector<Fork> forks(philosophers_num);
+    std::vector<std::vector<Event>> events_lines(philosophers_num);
+    std::vector<std::thread> threads(philosophers_num);
+
+    BenchResult result{.bench_case = bench_case, .run_durations = {}, .events_count = 0, .starvation_count = {}};
+    size_t starvations{};
+
+    for (int times = -warmup_times; times < options.run_times; ++times) {
+        Philosopher::setFence(static_cast<int>(philosophers_num));
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t philosopher_id = 0; philosopher_id < philosophers_num; ++philosopher_id) {
+            auto& first_fork = forks[philosopher_id];
+            auto& second_fork = forks[(philosopher_id + 1) % philosophers_num];
+
+            Hand hand = main_hand_of(bench_case.policy, philosopher_id, philosophers_num);
+            threads[philosopher_id] = std::thread(Philosopher{philosopher_id, hand, events_lines[philosopher_id], first_fork, second_fork});
+        }
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        if (times < 0) { // warmup run
+            for (auto& events : events_lines) {
+                events.clear();
+            }
+            continue;
+        }
+        result.run_durations.push_back(duration);
+
+        for (auto& events : events_lines) { // count events of every run, then clear them for the next one
+            result.events_count += events.size();
+            starvations += static_cast<size_t>(std::ranges::count_if(events, [](const Event& event) {
+                return event.action == Action::Starve;
+            }));
+            events.clear();
+        }
+    }
+
+    if (bench_case.recording != EventRecording::None) {
+        result.starvation_count = starvations;
+    }
+    return result;
+}
+
+void print_json(std::ostream& out, const std::vector<BenchResult>& results, const BenchOptions& options) {
+    out << "{\n";
+    out << "  \"benchmark\": \"philosophers_bench\",\n";
+    out << "  \"build_type\": \"" << BENCH_BUILD_TYPE << "\",\n";
+    out << "  \"compiler\": \"" << BENCH_COMPILER << "\",\n";
+    out << "  \"warmup_times\": " << warmup_times << ",\n";
+    out << "  \"run_times\": " << options.run_times << ",\n";
+    out << "  \"eating_times_count\": " << options.eating_times_count << ",\n";
+    out << "  \"results\": [\n";
+
+    for (size_t index = 0; index < results.size(); ++index) {
+        const auto& result = results[index];
+        const auto& bench_case = result.bench_case;
+        auto durations = result.run_durations;
+        std::ranges::sort(durations);
+
+        const auto total = std::accumulate(durations.begin(), durations.end(), std::chrono::nanoseconds{});
+        const auto mean_ns = static_cast<double>(total.count()) / static_cast<double>(durations.size());
+        const auto middle = durations.size() / 2;
+        const auto median_ns = (durations.size() % 2 == 0)
+            ? (durations[middle - 1].count() + durations[middle].count()) / 2
+            : durations[middle].count();
+        const auto meals = bench_case.philosophers_num * options.eating_times_count;
+
+        out << "    {";
+        out << "\"philosophers\": " << bench_case.philosophers_num << ", ";
+        out << "\"acquire_policy\": \"" << name_of(bench_case.policy) << "\", ";
+        out << "\"work_strategy\": \"" << name_of(bench_case.strategy) << "\", ";
+        out << "\"event_recording\": \"" << name_of(bench_case.recording) << "\", ";
+        out << "\"min_ns\": " << durations.front().count() << ", ";
+        out << "\"median_ns\": " << median_ns << ", ";
+        out << "\"mean_ns\": " << static_cast<long long>(mean_ns) << ", ";
+        out << "\"max_ns\": " << durations.back().count() << ", ";
+        out << "\"mean_ns_per_meal\": " << static_cast<long long>(mean_ns / static_cast<double>(meals)) << ", ";
+        out << "\"total_events\": " << result.events_count << ", ";
+        out << "\"total_starvations\": ";
+        if (result.starvation_count) {
+            out << *result.starvation_count;
+        } else {
+            out << "null";
+        }
+        out << "}" << (index + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// accepts only a whole unsigned decimal number that fits in T
+template <typename T>
+auto parse_count(std::string_view text) -> std::optional<T> {
+    T value{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value); // unsigned T rejects '-'
+    if (error != std::errc{} || end != text.data() + text.size()) {
+        return {};
+    }
+    return value;
+}
+
+// usage: philosophers_bench [output.json|-] [eating_times_count] [run_times]
+auto parse_options(int argc, char* argv[]) -> std::optional<BenchOptions> {
+    if (argc > 4) {
+        return {};
+    }
+
+    BenchOptions options;
+    if (argc > 1) {
+        options.output_path = argv[1];
+    }
+    if (argc > 2) {
+        const auto eating_times_count = parse_count<size_t>(argv[2]);
+        if (not eating_times_count || *eating_times_count == 0) {
+            return {};
+        }
+        options.eating_times_count = *eating_times_count;
+    }
+    if (argc > 3) {
+        const auto run_times = parse_count<unsigned>(argv[3]);
+        if (not run_times || *run_times == 0 || *run_times > static_cast<unsigned>(std::numeric_limits<int>::max())) {
+            return {};
+        }
+        options.run_times = static_cast<int>(*run_times);
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    const auto options = parse_options(argc, argv);
+    if (not options) {
+        std::cerr << "usage: " << argv[0] << " [output.json|-] [eating_times_count] [run_times]\n";
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+
+    for (auto philosophers_num : table_sizes) {
+        for (auto policy : acquire_policies) {
+            for (auto strategy : work_strategies) {
+                for (auto recording : event_recordings) {
+                    results.push_back(run_case({philosophers_num, policy, strategy, recording}, *options));
+                }
+            }
+        }
+    }
+
+    if (not options->output_path.empty() && options->output_path != "-") {
+        std::ofstream file{options->output_path};
+        if (not file) {
+            std::cerr << "Can't open output file: " << options->output_path << "\n";
+            return 1;
+        }
+        print_json(file, results, *options);
+        return 0;
+    }
+    print_json(std::cout, results, *options);
+}
@@ -1,6 +1,7 @@
 #include "Philosopher.hpp"
 #include "PrintEvents.hpp"
 #include <thread>
+#include <iostream>
 #include <array>
 #include <algorithm>
 #include <list>
@@ -11,21 +12,29 @@ using namespace std::chrono_literals;
 constexpr auto philosophers_num = 5;
 constexpr auto run_times = 2;
 constexpr auto philosophers_eating_times_count = 300;
-std::chrono::milliseconds print_delay = 0ms;
-bool print_color_by_philosopher = false; // limited to 6 philosophers - enum Color limit
-bool print_reset_color_after = false;
 constexpr auto print_all = false;
 constexpr auto print_part_range = 200;
 
-const size_t Philosopher::eating_times_count = philosophers_eating_times_count;
-const int Philosopher::eating_time_minimum = 50;
-const int Philosopher::eating_time_maximum = 200;
-const int Philosopher::thinking_time_minimum = 50;
-const int Philosopher::thinking_time_maximum = 200;
+constexpr auto acquire_policy = AcquirePolicy::LastRightHanded;
 
 int main() {
     static_assert(philosophers_num > 1);
 
+    Philosopher::setSettings({
+        .eating_times_count = philosophers_eating_times_count,
+        .eating_time_minimum = 50,
+        .eating_time_maximum = 200,
+        .thinking_time_minimum = 50,
+        .thinking_time_maximum = 200,
+        .recording = EventRecording::Full
+    });
+    TimedWork::setStrategy(WorkStrategy::BusySleep);
+    set_print_settings({
+        .print_delay = 0ms,
+        .print_color_by_philosopher = false, // limited to 6 philosophers - enum Color limit
+        .print_reset_color_after = false
+    });
+
     std::array<Fork, philosophers_num> forks;
     std::array<std::vector<Event>, philosophers_num> events_lines;
     std::array<std::thread, philosophers_num> threads;
@@ -47,7 +56,7 @@ int main() {
             }
             const auto second_fork = std::ref(*it);
 
-            Hand hand = (philosopher_id == philosophers_num - 1) ? Hand::Right : Hand::Left;
+            Hand hand = main_hand_of(acquire_policy, philosopher_id, philosophers_num);
             threads[philosopher_id] = std::thread(Philosopher{philosopher_id, hand, events_lines[philosopher_id], first_fork, second_fork});
         }
 
@@ -83,12 +92,12 @@ int main() {
     } ();
     
     if (print_all || (print_part_range > all_events.size()/2)) {
-        print_events<philosophers_num>(all_events);
+        print_events(all_events, philosophers_num);
     } else {
 #ifndef __clang__
-        print_events<philosophers_num>(all_events | std::views::take(print_part_range));
+        print_events(all_events | std::views::take(print_part_range), philosophers_num);
         std::cout << "\n  .....\n\n";
-        print_events<philosophers_num>(all_events | std::views::drop(all_events.size() - print_part_range));
+        print_events(all_events | std::views::drop(all_events.size() - print_part_range), philosophers_num);
 #else
         std::cout << "INFO: Printing parts of events feature not supported yet (no support in clang 15).\n";
 #endif